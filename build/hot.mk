@@ -8,9 +8,11 @@ HOT_SOURCES = \
 	$(JASPER_SOURCES) \
 	$(SRC)/MapWindow/OverlayBitmap.cpp \
 	$(SRC)/Topography/TopographyFileRenderer.cpp \
+	$(SRC)/Terrain/Bilinear.cpp \
 	$(SRC)/Terrain/RasterBuffer.cpp \
 	$(SRC)/Terrain/RasterMap.cpp \
 	$(SRC)/Terrain/HeightMatrix.cpp \
+	$(SRC)/Terrain/ShadeMatrix.cpp \
 	$(SRC)/Terrain/RasterRenderer.cpp \
 	$(SRC)/Terrain/RasterTile.cpp \
 	$(SRC)/Terrain/ScanLine.cpp \
@@ -19,6 +21,7 @@ HOT_SOURCES = \
 	$(SRC)/ui/canvas/memory/Canvas.cpp \
 	$(ENGINE_SRC_DIR)/Waypoints/Waypoints.cpp \
 	$(ENGINE_SRC_DIR)/Airspace/Airspaces.cpp \
+	$(ENGINE_SRC_DIR)/Airspace/AirspacePolygon.cpp \
 	$(ENGINE_SRC_DIR)/Task/Shapes/FAITriangleArea.cpp \
 	$(ENGINE_SRC_DIR)/GlideSolvers/MacCready.cpp \
 	$(ENGINE_SRC_DIR)/GlideSolvers/GlidePolar.cpp \
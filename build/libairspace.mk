@@ -4,6 +4,7 @@ AIRSPACE_SOURCES = \
 	$(ENGINE_SRC_DIR)/Util/AircraftStateFilter.cpp \
 	$(ENGINE_SRC_DIR)/Util/VarioOutputFilter.cpp \
 	$(AIRSPACE_SRC_DIR)/AirspacesTerrain.cpp \
+	$(AIRSPACE_SRC_DIR)/AirspacesCorridor.cpp \
 	$(AIRSPACE_SRC_DIR)/Airspace.cpp \
 	$(AIRSPACE_SRC_DIR)/AirspaceAltitude.cpp \
 	$(AIRSPACE_SRC_DIR)/AirspaceAircraftPerformance.cpp \
@@ -29,6 +29,8 @@ GEO_SOURCES := \
 	$(GEO_SRC_DIR)/Quadrilateral.cpp \
 	$(GEO_SRC_DIR)/SearchPoint.cpp \
 	$(GEO_SRC_DIR)/SearchPointVector.cpp \
+	$(GEO_SRC_DIR)/PolygonEdgeIndex.cpp \
+	$(GEO_SRC_DIR)/PolygonDetailLevels.cpp \
 	$(GEO_SRC_DIR)/GeoEllipse.cpp \
 	$(GEO_SRC_DIR)/UTM.cpp
 
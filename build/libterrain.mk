@@ -1,18 +1,24 @@
 TERRAIN_SOURCES = \
 	$(SRC)/Terrain/AsyncLoader.cpp \
+	$(SRC)/Terrain/Bilinear.cpp \
 	$(SRC)/Terrain/RasterBuffer.cpp \
 	$(SRC)/Terrain/RasterProjection.cpp \
 	$(SRC)/Terrain/RasterMap.cpp \
+	$(SRC)/Terrain/RasterPyramid.cpp \
 	$(SRC)/Terrain/RasterTile.cpp \
 	$(SRC)/Terrain/RasterTileCache.cpp \
 	$(SRC)/Terrain/ZzipStream.cpp \
 	$(SRC)/Terrain/Loader.cpp \
+	$(SRC)/Terrain/Prefetch.cpp \
+	$(SRC)/Terrain/TileStore.cpp \
 	$(SRC)/Terrain/WorldFile.cpp \
 	$(SRC)/Terrain/Intersection.cpp \
 	$(SRC)/Terrain/ScanLine.cpp \
+	$(SRC)/Terrain/ProfileCache.cpp \
 	$(SRC)/Terrain/RasterTerrain.cpp \
 	$(SRC)/Terrain/Thread.cpp \
 	$(SRC)/Terrain/HeightMatrix.cpp \
+	$(SRC)/Terrain/ShadeMatrix.cpp \
 	$(SRC)/Terrain/RasterRenderer.cpp \
 	$(SRC)/Terrain/TerrainRenderer.cpp \
 	$(SRC)/Terrain/TerrainSettings.cpp
@@ -9,6 +9,7 @@ PYTHON_SOURCES = \
 	$(SRC)/IGC/IGCFix.cpp \
 	$(ENGINE_SRC_DIR)/Trace/Point.cpp \
 	$(ENGINE_SRC_DIR)/Trace/Trace.cpp \
+	$(ENGINE_SRC_DIR)/Trace/CompactTrace.cpp \
 	$(SRC)/Computer/CirclingComputer.cpp \
 	$(SRC)/Computer/Wind/Settings.cpp \
 	$(SRC)/Computer/Wind/WindEKF.cpp \
@@ -54,6 +54,7 @@ define link-harness-program
 $(1)_SOURCES = \
 	$(SRC)/Engine/Trace/Point.cpp \
 	$(SRC)/Engine/Trace/Trace.cpp \
+	$(SRC)/Engine/Trace/CompactTrace.cpp \
 	$(SRC)/Engine/Trace/Vector.cpp \
 	$(SRC)/Engine/Navigation/Aircraft.cpp \
 	$(SRC)/Engine/Util/Gradient.cpp \
@@ -79,6 +80,9 @@ TEST_NAMES = \
 	test_task \
 	TestInputTransformMode \
 	TestOverwritingRingBuffer \
+	TestSnapshotBuffer \
+	TestScreenGridIndex \
+	TestCompactTrace \
 	TestDateTime TestISO8601 TestRoughTime TestRoughSpeed TestWrapClock \
 	TestPolylineDecoder \
 	TestTransponderCode \
@@ -105,11 +109,16 @@ TEST_NAMES = \
 	TestTeamCode \
 	TestZeroFinder \
 	TestAirspaceWarningManager \
+	TestAirspacePolygon \
+	TestAirspaceDetailLevels \
+	TestAirspaceCorridor \
 	TestAirspaceParser \
 	TestOGNAprsParser \
 	TestMETARParser \
 	TestIGCParser \
 	TestTraceBounds \
+	TestTraceBoxTree \
+	TestContestParallel \
 	TestStrings TestUnescapeCString TestUTF8 TestWrapText \
 	TestInputConfig \
 	TestCRC16 TestCRC8 \
@@ -221,6 +230,18 @@ TEST_OVERWRITING_RING_BUFFER_SOURCES = \
 TEST_OVERWRITING_RING_BUFFER_DEPENDS = MATH
 $(eval $(call link-program,TestOverwritingRingBuffer,TEST_OVERWRITING_RING_BUFFER))
 
+TEST_SNAPSHOT_BUFFER_SOURCES = \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/TestSnapshotBuffer.cpp
+TEST_SNAPSHOT_BUFFER_DEPENDS = MATH
+$(eval $(call link-program,TestSnapshotBuffer,TEST_SNAPSHOT_BUFFER))
+
+TEST_SCREEN_GRID_INDEX_SOURCES = \
+	$(SRC)/Renderer/ScreenGridIndex.cpp \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/TestScreenGridIndex.cpp
+$(eval $(call link-program,TestScreenGridIndex,TEST_SCREEN_GRID_INDEX))
+
 TEST_IGC_PARSER_SOURCES = \
 	$(SRC)/IGC/IGCParser.cpp \
 	$(TEST_SRC_DIR)/tap.c \
@@ -350,6 +371,33 @@ TEST_AIRSPACE_WARNING_MANAGER_SOURCES = \
 TEST_AIRSPACE_WARNING_MANAGER_DEPENDS = $(TEST1_DEPENDS) UNITS
 $(eval $(call link-program,TestAirspaceWarningManager,TEST_AIRSPACE_WARNING_MANAGER))
 
+TEST_AIRSPACE_POLYGON_SOURCES = \
+	$(SRC)/Atmosphere/Pressure.cpp \
+	$(TEST_SRC_DIR)/FakeLogFile.cpp \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/AirspaceShapes.cpp \
+	$(TEST_SRC_DIR)/TestAirspacePolygon.cpp
+TEST_AIRSPACE_POLYGON_DEPENDS = AIRSPACE GEO MATH UTIL UNITS FMT
+$(eval $(call link-program,TestAirspacePolygon,TEST_AIRSPACE_POLYGON))
+
+TEST_AIRSPACE_DETAIL_LEVELS_SOURCES = \
+	$(SRC)/Atmosphere/Pressure.cpp \
+	$(TEST_SRC_DIR)/FakeLogFile.cpp \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/AirspaceShapes.cpp \
+	$(TEST_SRC_DIR)/TestAirspaceDetailLevels.cpp
+TEST_AIRSPACE_DETAIL_LEVELS_DEPENDS = AIRSPACE GEO MATH UTIL UNITS FMT
+$(eval $(call link-program,TestAirspaceDetailLevels,TEST_AIRSPACE_DETAIL_LEVELS))
+
+TEST_AIRSPACE_CORRIDOR_SOURCES = \
+	$(SRC)/Atmosphere/Pressure.cpp \
+	$(TEST_SRC_DIR)/FakeLogFile.cpp \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/AirspaceShapes.cpp \
+	$(TEST_SRC_DIR)/TestAirspaceCorridor.cpp
+TEST_AIRSPACE_CORRIDOR_DEPENDS = AIRSPACE GEO MATH UTIL UNITS FMT
+$(eval $(call link-program,TestAirspaceCorridor,TEST_AIRSPACE_CORRIDOR))
+
 TEST_OGN_APRS_PARSER_SOURCES = \
 	$(SRC)/Cloud/OGNAprs.cpp \
 	$(SRC)/Cloud/OGNTraffic.cpp \
@@ -1084,6 +1132,7 @@ TEST_TRACE_SOURCES = \
 	$(TEST_SRC_DIR)/tap.c \
 	$(SRC)/Engine/Trace/Point.cpp \
 	$(SRC)/Engine/Trace/Trace.cpp \
+	$(SRC)/Engine/Trace/CompactTrace.cpp \
 	$(SRC)/IGC/IGCParser.cpp \
 	$(TEST_SRC_DIR)/FakeTerrain.cpp \
 	$(TEST_SRC_DIR)/Printing.cpp \
@@ -1095,10 +1144,37 @@ TEST_TRACE_BOUNDS_SOURCES = \
 	$(TEST_SRC_DIR)/tap.c \
 	$(SRC)/Engine/Trace/Point.cpp \
 	$(SRC)/Engine/Trace/Trace.cpp \
+	$(SRC)/Engine/Trace/CompactTrace.cpp \
 	$(TEST_SRC_DIR)/TestTraceBounds.cpp
 TEST_TRACE_BOUNDS_DEPENDS = GEO MATH UTIL
 $(eval $(call link-program,TestTraceBounds,TEST_TRACE_BOUNDS))
 
+TEST_TRACE_BOX_TREE_SOURCES = \
+	$(TEST_SRC_DIR)/tap.c \
+	$(TEST_SRC_DIR)/TestTraceBoxTree.cpp
+TEST_TRACE_BOX_TREE_DEPENDS = GEO MATH
+$(eval $(call link-program,TestTraceBoxTree,TEST_TRACE_BOX_TREE))
+
+TEST_CONTEST_PARALLEL_SOURCES = \
+	$(TEST_SRC_DIR)/tap.c \
+	$(SRC)/IGC/IGCParser.cpp \
+	$(SRC)/Engine/Trace/Point.cpp \
+	$(SRC)/Engine/Trace/Trace.cpp \
+	$(SRC)/Engine/Trace/CompactTrace.cpp \
+	$(TEST_SRC_DIR)/IGCFixes.cpp \
+	$(TEST_SRC_DIR)/TestContestParallel.cpp
+TEST_CONTEST_PARALLEL_DEPENDS = CONTEST IO OS GEO MATH UTIL TIME
+$(eval $(call link-program,TestContestParallel,TEST_CONTEST_PARALLEL))
+
+TEST_COMPACT_TRACE_SOURCES = \
+	$(TEST_SRC_DIR)/tap.c \
+	$(SRC)/Engine/Trace/Point.cpp \
+	$(SRC)/Engine/Trace/Trace.cpp \
+	$(SRC)/Engine/Trace/CompactTrace.cpp \
+	$(TEST_SRC_DIR)/TestCompactTrace.cpp
+TEST_COMPACT_TRACE_DEPENDS = GEO MATH UTIL
+$(eval $(call link-program,TestCompactTrace,TEST_COMPACT_TRACE))
+
 FLIGHT_TABLE_SOURCES = \
 	$(SRC)/IGC/IGCParser.cpp \
 	$(SRC)/Repository/FileType.cpp \
@@ -1126,6 +1202,11 @@ DEBUG_PROGRAM_NAMES = \
 	FlightTable \
 	BenchmarkProjection \
 	BenchmarkFAITriangleSector \
+	BenchmarkTerrainInterpolation \
+	BenchmarkTerrainLoad \
+	BenchmarkTrace \
+	BenchmarkAirspaceWarnings \
+	BenchmarkContest \
 	DumpTextInflate \
 	DumpHexColor \
 	RunXMLParser \
@@ -1294,6 +1375,35 @@ BENCHMARK_PROJECTION_DEPENDS = MATH
 BENCHMARK_PROJECTION_CPPFLAGS = $(SCREEN_CPPFLAGS)
 $(eval $(call link-program,BenchmarkProjection,BENCHMARK_PROJECTION))
 
+BENCHMARK_TRACE_SOURCES = \
+	$(SRC)/IGC/IGCParser.cpp \
+	$(SRC)/Engine/Trace/Point.cpp \
+	$(SRC)/Engine/Trace/Trace.cpp \
+	$(SRC)/Engine/Trace/CompactTrace.cpp \
+	$(TEST_SRC_DIR)/IGCFixes.cpp \
+	$(TEST_SRC_DIR)/BenchmarkTrace.cpp
+BENCHMARK_TRACE_DEPENDS = IO OS GEO MATH UTIL
+$(eval $(call link-program,BenchmarkTrace,BENCHMARK_TRACE))
+
+BENCHMARK_AIRSPACE_WARNINGS_SOURCES = \
+	$(SRC)/Atmosphere/Pressure.cpp \
+	$(SRC)/Engine/Navigation/Aircraft.cpp \
+	$(TEST_SRC_DIR)/FakeLogFile.cpp \
+	$(TEST_SRC_DIR)/AirspaceShapes.cpp \
+	$(TEST_SRC_DIR)/BenchmarkAirspaceWarnings.cpp
+BENCHMARK_AIRSPACE_WARNINGS_DEPENDS = $(TEST1_DEPENDS) UNITS
+$(eval $(call link-program,BenchmarkAirspaceWarnings,BENCHMARK_AIRSPACE_WARNINGS))
+
+BENCHMARK_CONTEST_SOURCES = \
+	$(SRC)/IGC/IGCParser.cpp \
+	$(SRC)/Engine/Trace/Point.cpp \
+	$(SRC)/Engine/Trace/Trace.cpp \
+	$(SRC)/Engine/Trace/CompactTrace.cpp \
+	$(TEST_SRC_DIR)/IGCFixes.cpp \
+	$(TEST_SRC_DIR)/BenchmarkContest.cpp
+BENCHMARK_CONTEST_DEPENDS = CONTEST IO OS GEO MATH UTIL TIME
+$(eval $(call link-program,BenchmarkContest,BENCHMARK_CONTEST))
+
 BENCHMARK_FAI_TRIANGLE_SECTOR_SOURCES = \
 	$(ENGINE_SRC_DIR)/Task/Shapes/FAITriangleSettings.cpp \
 	$(ENGINE_SRC_DIR)/Task/Shapes/FAITriangleArea.cpp \
@@ -1546,6 +1656,21 @@ RUN_HEIGHT_MATRIX_CPPFLAGS = $(SCREEN_CPPFLAGS)
 RUN_HEIGHT_MATRIX_DEPENDS = TERRAIN OPERATION GEO MATH IO OS ZZIP UTIL
 $(eval $(call link-program,RunHeightMatrix,RUN_HEIGHT_MATRIX))
 
+BENCHMARK_TERRAIN_INTERPOLATION_SOURCES = \
+	$(TEST_SRC_DIR)/FakeLogFile.cpp \
+	$(SRC)/Operation/ConsoleOperationEnvironment.cpp \
+	$(TEST_SRC_DIR)/BenchmarkTerrainInterpolation.cpp
+BENCHMARK_TERRAIN_INTERPOLATION_CPPFLAGS = $(SCREEN_CPPFLAGS)
+BENCHMARK_TERRAIN_INTERPOLATION_DEPENDS = TERRAIN OPERATION GEO MATH IO OS ZZIP UTIL
+$(eval $(call link-program,BenchmarkTerrainInterpolation,BENCHMARK_TERRAIN_INTERPOLATION))
+
+BENCHMARK_TERRAIN_LOAD_SOURCES = \
+	$(TEST_SRC_DIR)/FakeLogFile.cpp \
+	$(TEST_SRC_DIR)/BenchmarkTerrainLoad.cpp
+BENCHMARK_TERRAIN_LOAD_CPPFLAGS = $(SCREEN_CPPFLAGS)
+BENCHMARK_TERRAIN_LOAD_DEPENDS = TERRAIN OPERATION GEO MATH IO OS ZZIP UTIL
+$(eval $(call link-program,BenchmarkTerrainLoad,BENCHMARK_TERRAIN_LOAD))
+
 RUN_INPUT_PARSER_SOURCES = \
 	$(SRC)/Input/InputKeys.cpp \
 	$(SRC)/Input/InputConfig.cpp \
@@ -1588,6 +1713,7 @@ $(eval $(call link-program,RunFlightParser,RUN_FLIGHT_PARSER))
 
 RUN_AIRSPACE_PARSER_SOURCES = \
 	$(SRC)/Airspace/AirspaceParser.cpp \
+	$(SRC)/Airspace/AirspaceCache.cpp \
 	$(SRC)/Atmosphere/Pressure.cpp \
 	$(SRC)/RadioFrequency.cpp \
 	$(SRC)/TransponderCode.cpp \
@@ -1966,6 +2092,7 @@ RUN_TRAIL_RENDERER_STRESS_SOURCES = \
 	$(SRC)/Computer/TraceComputer.cpp \
 	$(SRC)/Engine/Trace/Point.cpp \
 	$(SRC)/Engine/Trace/Trace.cpp \
+	$(SRC)/Engine/Trace/CompactTrace.cpp \
 	$(SRC)/Engine/Trace/Vector.cpp \
 	$(SRC)/Projection/Projection.cpp \
 	$(SRC)/Projection/WindowProjection.cpp \
@@ -1992,6 +2119,7 @@ RUN_TRACE_SOURCES = \
 	$(ENGINE_SRC_DIR)/GlideSolvers/GlideSettings.cpp \
 	$(ENGINE_SRC_DIR)/Trace/Point.cpp \
 	$(ENGINE_SRC_DIR)/Trace/Trace.cpp \
+	$(ENGINE_SRC_DIR)/Trace/CompactTrace.cpp \
 	$(TEST_SRC_DIR)/Printing.cpp \
 	$(TEST_SRC_DIR)/RunTrace.cpp
 RUN_TRACE_DEPENDS = $(DEBUG_REPLAY_DEPENDS) UTIL LIBNMEA GEO MATH TIME
@@ -2005,6 +2133,7 @@ RUN_CONTEST_SOURCES = \
 	$(SRC)/FLARM/Error.cpp \
 	$(ENGINE_SRC_DIR)/Trace/Point.cpp \
 	$(ENGINE_SRC_DIR)/Trace/Trace.cpp \
+	$(ENGINE_SRC_DIR)/Trace/CompactTrace.cpp \
 	$(TEST_SRC_DIR)/FakeTerrain.cpp \
 	$(TEST_SRC_DIR)/Printing.cpp \
 	$(TEST_SRC_DIR)/ContestPrinting.cpp \
@@ -2022,6 +2151,7 @@ RUN_WAVE_COMPUTER_SOURCES = \
 	$(SRC)/FLARM/Error.cpp \
 	$(ENGINE_SRC_DIR)/Trace/Point.cpp \
 	$(ENGINE_SRC_DIR)/Trace/Trace.cpp \
+	$(ENGINE_SRC_DIR)/Trace/CompactTrace.cpp \
 	$(TEST_SRC_DIR)/RunWaveComputer.cpp
 RUN_WAVE_COMPUTER_DEPENDS = $(DEBUG_REPLAY_DEPENDS) UTIL GEO MATH TIME
 $(eval $(call link-program,RunWaveComputer,RUN_WAVE_COMPUTER))
@@ -2035,6 +2165,7 @@ ANALYSE_FLIGHT_SOURCES = \
 	$(SRC)/TransponderCode.cpp \
 	$(ENGINE_SRC_DIR)/Trace/Point.cpp \
 	$(ENGINE_SRC_DIR)/Trace/Trace.cpp \
+	$(ENGINE_SRC_DIR)/Trace/CompactTrace.cpp \
 	$(ENGINE_SRC_DIR)/ThermalBand/ThermalBand.cpp \
     $(ENGINE_SRC_DIR)/ThermalBand/ThermalSlice.cpp \
 	$(ENGINE_SRC_DIR)/ThermalBand/ThermalEncounterBand.cpp \
@@ -2058,6 +2189,7 @@ FLIGHT_PATH_SOURCES = \
 	$(ENGINE_SRC_DIR)/GlideSolvers/GlideSettings.cpp \
 	$(ENGINE_SRC_DIR)/Trace/Point.cpp \
 	$(ENGINE_SRC_DIR)/Trace/Trace.cpp \
+	$(ENGINE_SRC_DIR)/Trace/CompactTrace.cpp \
 	$(TEST_SRC_DIR)/Printing.cpp \
 	$(TEST_SRC_DIR)/FlightPath.cpp
 FLIGHT_PATH_DEPENDS = $(DEBUG_REPLAY_DEPENDS) UTIL GEO MATH TIME
@@ -2134,6 +2266,7 @@ RUN_MAP_WINDOW_SOURCES = \
 	$(SRC)/Engine/Util/Gradient.cpp \
 	$(SRC)/Engine/Trace/Point.cpp \
 	$(SRC)/Engine/Trace/Trace.cpp \
+	$(SRC)/Engine/Trace/CompactTrace.cpp \
 	$(SRC)/Engine/Trace/Vector.cpp \
 	$(SRC)/Engine/Navigation/Aircraft.cpp \
 	$(ENGINE_SRC_DIR)/ThermalBand/ThermalBand.cpp \
@@ -2151,6 +2284,8 @@ RUN_MAP_WINDOW_SOURCES = \
 	$(SRC)/Airspace/ProtectedAirspaceWarningManager.cpp \
 	$(SRC)/Airspace/AirspaceParser.cpp \
 	$(SRC)/Airspace/AirspaceGlue.cpp \
+	$(SRC)/Airspace/AirspaceCache.cpp \
+	$(SRC)/Airspace/AirspaceFragmentCache.cpp \
 	$(SRC)/Airspace/AirspaceVisibility.cpp \
 	$(SRC)/Airspace/AirspaceComputerSettings.cpp \
 	$(SRC)/Renderer/GeoBitmapRenderer.cpp \
@@ -2174,9 +2309,12 @@ RUN_MAP_WINDOW_SOURCES = \
 	$(SRC)/Renderer/AircraftRenderer.cpp \
 	$(SRC)/Renderer/AirspaceRenderer.cpp \
 	$(SRC)/Renderer/AirspaceRendererGL.cpp \
+	$(SRC)/Renderer/AirspaceMeshCache.cpp \
 	$(SRC)/Renderer/AirspaceRendererOther.cpp \
 	$(SRC)/Renderer/AirspaceLabelList.cpp \
 	$(SRC)/Renderer/AirspaceLabelRenderer.cpp \
+	$(SRC)/Renderer/ScreenGridIndex.cpp \
+	$(SRC)/Renderer/AirspaceScreenIndex.cpp \
 	$(SRC)/Renderer/BestCruiseArrowRenderer.cpp \
 	$(SRC)/Renderer/CompassRenderer.cpp \
 	$(SRC)/Renderer/FinalGlideBarRenderer.cpp \
@@ -2564,6 +2702,7 @@ RUN_ANALYSIS_SOURCES = \
 	$(SRC)/Engine/Util/Gradient.cpp \
 	$(SRC)/Engine/Trace/Point.cpp \
 	$(SRC)/Engine/Trace/Trace.cpp \
+	$(SRC)/Engine/Trace/CompactTrace.cpp \
 	$(SRC)/Engine/Trace/Vector.cpp \
 	$(ENGINE_SRC_DIR)/ThermalBand/ThermalBand.cpp \
 	$(SRC)/UIUtil/GestureManager.cpp \
@@ -2589,6 +2728,7 @@ RUN_ANALYSIS_SOURCES = \
 	$(SRC)/Renderer/GeoBitmapRenderer.cpp \
 	$(SRC)/Renderer/AirspaceRenderer.cpp \
 	$(SRC)/Renderer/AirspaceRendererGL.cpp \
+	$(SRC)/Renderer/AirspaceMeshCache.cpp \
 	$(SRC)/Renderer/AirspaceRendererOther.cpp \
 	$(SRC)/Renderer/TransparentRendererCache.cpp \
 	$(SRC)/Renderer/GradientRenderer.cpp \
@@ -2656,6 +2796,8 @@ RUN_ANALYSIS_SOURCES = \
 	$(SRC)/Airspace/ProtectedAirspaceWarningManager.cpp \
 	$(SRC)/Airspace/AirspaceParser.cpp \
 	$(SRC)/Airspace/AirspaceGlue.cpp \
+	$(SRC)/Airspace/AirspaceCache.cpp \
+	$(SRC)/Airspace/AirspaceFragmentCache.cpp \
 	$(SRC)/Airspace/AirspaceVisibility.cpp \
 	$(SRC)/Airspace/AirspaceComputerSettings.cpp \
 	$(SRC)/Renderer/AirspaceRendererSettings.cpp \
@@ -2727,6 +2869,8 @@ RUN_AIRSPACE_WARNING_DIALOG_SOURCES = \
 	$(SRC)/Repository/FileType.cpp \
 	$(SRC)/Airspace/AirspaceParser.cpp \
 	$(SRC)/Airspace/AirspaceGlue.cpp \
+	$(SRC)/Airspace/AirspaceCache.cpp \
+	$(SRC)/Airspace/AirspaceFragmentCache.cpp \
 	$(SRC)/TransponderCode.cpp \
 	$(SRC)/Audio/Sound.cpp \
 	$(MORE_SCREEN_SOURCES) \